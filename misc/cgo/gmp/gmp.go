@@ -111,6 +111,123 @@ void _mpz_mul_2exp(mpz_ptr a, mpz_ptr b, unsigned long n) {
 void _mpz_div_2exp(mpz_ptr a, mpz_ptr b, unsigned long n) {
 	mpz_div_2exp(a, b, n);
 }
+
+// gmp has only unsigned versions of these two.
+void _mpz_addmul_si(mpz_ptr a, mpz_ptr b, long n) {
+	if(n >= 0)
+		mpz_addmul_ui(a, b, n);
+	else
+		mpz_submul_ui(a, b, -(unsigned long)n);
+}
+void _mpz_submul_si(mpz_ptr a, mpz_ptr b, long n) {
+	if(n >= 0)
+		mpz_submul_ui(a, b, n);
+	else
+		mpz_addmul_ui(a, b, -(unsigned long)n);
+}
+
+// Initialize or clear the n mpz_t that start at p, stride bytes apart,
+// for Pool.
+void _mpz_init_n(void *p, size_t stride, int n) {
+	int i;
+
+	for(i = 0; i < n; i++)
+		mpz_init((mpz_ptr)((char*)p + i*stride));
+}
+void _mpz_clear_n(void *p, size_t stride, int n) {
+	int i;
+
+	for(i = 0; i < n; i++)
+		mpz_clear((mpz_ptr)((char*)p + i*stride));
+}
+
+// Operations of a Program, each followed in the code by its operands.
+enum {
+	opSet,		// z x
+	opSetInt64,	// z v
+	opAdd,		// z x y
+	opSub,		// z x y
+	opMul,		// z x y
+	opMulInt64,	// z x v
+	opAddMulInt64,	// z x v
+	opSubMulInt64,	// z x v
+	opLsh,		// z x s
+	opDivMod,	// q r x y
+	opCmp,		// x y
+	opInt64,	// x
+	opStopIfCmp,	// x y c
+};
+
+// _mpz_run runs the n words of code on the mpz_t in regs, storing
+// the results of opCmp and opInt64 in results.  It returns the number
+// of results, or -1 minus that number if an opStopIfCmp stopped it.
+int _mpz_run(mpz_ptr *regs, long *code, int n, long *results) {
+	long *pc, *end;
+	int nr, c;
+
+	nr = 0;
+	end = code + n;
+	for(pc = code; pc < end; ) {
+		switch(*pc++) {
+		case opSet:
+			mpz_set(regs[pc[0]], regs[pc[1]]);
+			pc += 2;
+			break;
+		case opSetInt64:
+			mpz_set_si(regs[pc[0]], pc[1]);
+			pc += 2;
+			break;
+		case opAdd:
+			mpz_add(regs[pc[0]], regs[pc[1]], regs[pc[2]]);
+			pc += 3;
+			break;
+		case opSub:
+			mpz_sub(regs[pc[0]], regs[pc[1]], regs[pc[2]]);
+			pc += 3;
+			break;
+		case opMul:
+			mpz_mul(regs[pc[0]], regs[pc[1]], regs[pc[2]]);
+			pc += 3;
+			break;
+		case opMulInt64:
+			mpz_mul_si(regs[pc[0]], regs[pc[1]], pc[2]);
+			pc += 3;
+			break;
+		case opAddMulInt64:
+			_mpz_addmul_si(regs[pc[0]], regs[pc[1]], pc[2]);
+			pc += 3;
+			break;
+		case opSubMulInt64:
+			_mpz_submul_si(regs[pc[0]], regs[pc[1]], pc[2]);
+			pc += 3;
+			break;
+		case opLsh:
+			_mpz_mul_2exp(regs[pc[0]], regs[pc[1]], pc[2]);
+			pc += 3;
+			break;
+		case opDivMod:
+			mpz_tdiv_qr(regs[pc[0]], regs[pc[1]], regs[pc[2]], regs[pc[3]]);
+			pc += 4;
+			break;
+		case opCmp:
+			c = mpz_cmp(regs[pc[0]], regs[pc[1]]);
+			results[nr++] = (c > 0) - (c < 0);
+			pc += 2;
+			break;
+		case opInt64:
+			results[nr++] = mpz_get_si(regs[pc[0]]);
+			pc += 1;
+			break;
+		case opStopIfCmp:
+			c = mpz_cmp(regs[pc[0]], regs[pc[1]]);
+			if((c > 0) - (c < 0) >= pc[2])
+				return -1 - nr;
+			pc += 3;
+			break;
+		}
+	}
+	return nr;
+}
 */
 import "C"
 
@@ -273,6 +390,50 @@ func (z *Int) Mod(x, y *Int) *Int {
 	return z
 }
 
+// MulInt64 sets z = x * y and returns z.
+func (z *Int) MulInt64(x *Int, y int64) *Int {
+	x.doinit()
+	z.doinit()
+	C.mpz_mul_si(&z.i[0], &x.i[0], C.long(y))
+	return z
+}
+
+// AddMul sets z = z + x * y and returns z.
+// It makes a single call into gmp, where Mul followed by Add makes two
+// and needs a temporary.
+func (z *Int) AddMul(x, y *Int) *Int {
+	x.doinit()
+	y.doinit()
+	z.doinit()
+	C.mpz_addmul(&z.i[0], &x.i[0], &y.i[0])
+	return z
+}
+
+// SubMul sets z = z - x * y and returns z.
+func (z *Int) SubMul(x, y *Int) *Int {
+	x.doinit()
+	y.doinit()
+	z.doinit()
+	C.mpz_submul(&z.i[0], &x.i[0], &y.i[0])
+	return z
+}
+
+// AddMulInt64 sets z = z + x * y and returns z.
+func (z *Int) AddMulInt64(x *Int, y int64) *Int {
+	x.doinit()
+	z.doinit()
+	C._mpz_addmul_si(&z.i[0], &x.i[0], C.long(y))
+	return z
+}
+
+// SubMulInt64 sets z = z - x * y and returns z.
+func (z *Int) SubMulInt64(x *Int, y int64) *Int {
+	x.doinit()
+	z.doinit()
+	C._mpz_submul_si(&z.i[0], &x.i[0], C.long(y))
+	return z
+}
+
 // Lsh sets z = x << s and returns z.
 func (z *Int) Lsh(x *Int, s uint) *Int {
 	x.doinit()
@@ -327,6 +488,216 @@ func (z *Int) Abs(x *Int) *Int {
 	return z
 }
 
+/*
+ * pools of temporaries
+ */
+
+// poolChunk is how many Ints a Pool initializes at a time.
+const poolChunk = 64
+
+// A Pool hands out Ints for temporary use and takes them all back at
+// once.  Each Int from a pool is initialized in a batch with others,
+// and is reused after Release, keeping the memory gmp allocated for
+// it, so temporaries taken from a pool cost neither an mpz_init nor
+// an mpz_clear each.  The zero value is an empty pool.
+type Pool struct {
+	chunks [][]Int
+	used   int // Ints handed out since the last Release
+}
+
+// Get returns an Int from the pool.  Its value is unspecified:
+// it may be left over from before the last Release.
+func (p *Pool) Get() *Int {
+	c, i := p.used/poolChunk, p.used%poolChunk
+	if c == len(p.chunks) {
+		chunk := make([]Int, poolChunk)
+		C._mpz_init_n(unsafe.Pointer(&chunk[0].i[0]), C.size_t(unsafe.Sizeof(chunk[0])), poolChunk)
+		for j := range chunk {
+			chunk[j].init = true
+		}
+		p.chunks = append(p.chunks, chunk)
+	}
+	p.used++
+	return &p.chunks[c][i]
+}
+
+// Release takes back all the Ints handed out by Get,
+// which must not be used again.
+func (p *Pool) Release() {
+	p.used = 0
+}
+
+// Free releases the Ints of the pool and the memory gmp holds for them.
+// The pool may be used again afterward.
+func (p *Pool) Free() {
+	for _, chunk := range p.chunks {
+		C._mpz_clear_n(unsafe.Pointer(&chunk[0].i[0]), C.size_t(unsafe.Sizeof(chunk[0])), poolChunk)
+		for j := range chunk {
+			chunk[j].init = false
+		}
+	}
+	p.chunks = nil
+	p.used = 0
+}
+
+/*
+ * programs
+ */
+
+// A Reg names an Int registered with a Program.
+// It may only be used with the Program that returned it.
+type Reg struct {
+	p *Program
+	i int
+}
+
+// A Program is a sequence of operations on Ints that runs with a
+// single call into gmp, instead of one call for each operation.
+// When the operands are small, the cost of those calls is most of the
+// cost of the operations themselves.
+//
+// The Ints a program works on are registered with Reg, and its
+// operations, recorded by the methods named after those of Int,
+// refer to them by their Reg.  Run runs the operations recorded so
+// far; Reset forgets them, so that the program can be recorded anew,
+// keeping the registered Ints.
+type Program struct {
+	ints    []*Int      // the registered Ints, for the garbage collector
+	regs    []C.mpz_ptr // and their mpz_t
+	code    []C.long
+	nres    int // results the code stores
+	res     []C.long
+	results []int64
+}
+
+// Reg registers z with p and returns its Reg.
+func (p *Program) Reg(z *Int) Reg {
+	z.doinit()
+	p.ints = append(p.ints, z)
+	p.regs = append(p.regs, &z.i[0])
+	return Reg{p, len(p.regs) - 1}
+}
+
+// Reset forgets the operations recorded in p.
+func (p *Program) Reset() {
+	p.code = p.code[:0]
+	p.nres = 0
+}
+
+func (p *Program) op(op C.long, args ...int64) {
+	p.code = append(p.code, op)
+	for _, a := range args {
+		p.code = append(p.code, C.long(a))
+	}
+}
+
+// reg returns the index of r in p.regs, which _mpz_run trusts,
+// after checking that r is a register of p.
+func (p *Program) reg(r Reg) int64 {
+	if r.p != p || r.i < 0 || r.i >= len(p.regs) {
+		panic("gmp: Reg not registered with this Program")
+	}
+	return int64(r.i)
+}
+
+// Set records z = x.
+func (p *Program) Set(z, x Reg) {
+	p.op(C.opSet, p.reg(z), p.reg(x))
+}
+
+// SetInt64 records z = v.
+func (p *Program) SetInt64(z Reg, v int64) {
+	p.op(C.opSetInt64, p.reg(z), v)
+}
+
+// Add records z = x + y.
+func (p *Program) Add(z, x, y Reg) {
+	p.op(C.opAdd, p.reg(z), p.reg(x), p.reg(y))
+}
+
+// Sub records z = x - y.
+func (p *Program) Sub(z, x, y Reg) {
+	p.op(C.opSub, p.reg(z), p.reg(x), p.reg(y))
+}
+
+// Mul records z = x * y.
+func (p *Program) Mul(z, x, y Reg) {
+	p.op(C.opMul, p.reg(z), p.reg(x), p.reg(y))
+}
+
+// MulInt64 records z = x * v.
+func (p *Program) MulInt64(z, x Reg, v int64) {
+	p.op(C.opMulInt64, p.reg(z), p.reg(x), v)
+}
+
+// AddMulInt64 records z = z + x * v.
+func (p *Program) AddMulInt64(z, x Reg, v int64) {
+	p.op(C.opAddMulInt64, p.reg(z), p.reg(x), v)
+}
+
+// SubMulInt64 records z = z - x * v.
+func (p *Program) SubMulInt64(z, x Reg, v int64) {
+	p.op(C.opSubMulInt64, p.reg(z), p.reg(x), v)
+}
+
+// Lsh records z = x << s.
+func (p *Program) Lsh(z, x Reg, s uint) {
+	p.op(C.opLsh, p.reg(z), p.reg(x), int64(s))
+}
+
+// DivMod records q = x / y and r = x % y, as DivModInt.
+func (p *Program) DivMod(q, r, x, y Reg) {
+	p.op(C.opDivMod, p.reg(q), p.reg(r), p.reg(x), p.reg(y))
+}
+
+// Cmp records a comparison of x and y, whose result, as for CmpInt,
+// Run returns, and returns the index of that result.
+func (p *Program) Cmp(x, y Reg) int {
+	p.op(C.opCmp, p.reg(x), p.reg(y))
+	p.nres++
+	return p.nres - 1
+}
+
+// Int64 records the conversion of x to int64, whose result Run
+// returns, and returns the index of that result.
+func (p *Program) Int64(x Reg) int {
+	p.op(C.opInt64, p.reg(x))
+	p.nres++
+	return p.nres - 1
+}
+
+// StopIfCmp records a test that stops the program if CmpInt(x, y) >= c.
+func (p *Program) StopIfCmp(x, y Reg, c int) {
+	p.op(C.opStopIfCmp, p.reg(x), p.reg(y), int64(c))
+}
+
+// Run runs the operations recorded in p and returns the results of
+// its Cmp and Int64 operations, which are valid until the next Run.
+// If a StopIfCmp stopped it, Run returns the results stored before
+// then, and ok = false.
+func (p *Program) Run() (results []int64, ok bool) {
+	if len(p.code) == 0 {
+		return nil, true
+	}
+	if len(p.res) < p.nres+1 {
+		p.res = make([]C.long, p.nres+1)
+	}
+	var regs *C.mpz_ptr
+	if len(p.regs) > 0 {
+		regs = &p.regs[0]
+	}
+	n := int(C._mpz_run(regs, &p.code[0], C.int(len(p.code)), &p.res[0]))
+	ok = n >= 0
+	if !ok {
+		n = -1 - n
+	}
+	p.results = p.results[:0]
+	for _, r := range p.res[:n] {
+		p.results = append(p.results, int64(r))
+	}
+	return p.results, ok
+}
+
 /*
  * functions without a clear receiver
  */
@@ -0,0 +1,204 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+package gmp
+
+import (
+	"io/ioutil"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"runtime"
+	"testing"
+)
+
+func TestFused(t *testing.T) {
+	x, y := NewInt(12345), NewInt(-678)
+	for _, tt := range []struct {
+		name string
+		z    *Int
+		want int64
+	}{
+		{"MulInt64", new(Int).MulInt64(x, -3), -37035},
+		{"AddMul", NewInt(7).AddMul(x, y), 7 + 12345*-678},
+		{"SubMul", NewInt(7).SubMul(x, y), 7 - 12345*-678},
+		{"AddMulInt64", NewInt(7).AddMulInt64(x, -5), 7 - 12345*5},
+		{"SubMulInt64", NewInt(7).SubMulInt64(x, -5), 7 + 12345*5},
+		{"AddMulInt64 aliased", NewInt(3).AddMulInt64(NewInt(3), 4), 15},
+	} {
+		if got := tt.z.Int64(); got != tt.want {
+			t.Errorf("%s = %d, want %d", tt.name, got, tt.want)
+		}
+	}
+}
+
+func TestPool(t *testing.T) {
+	var p Pool
+	var ints []*Int
+	for i := 0; i < 3*poolChunk/2; i++ {
+		z := p.Get().SetInt64(int64(i))
+		ints = append(ints, z)
+	}
+	for i, z := range ints {
+		if z.Int64() != int64(i) {
+			t.Fatalf("pool Int %d = %v", i, z)
+		}
+	}
+	p.Release()
+	if z := p.Get(); z != ints[0] {
+		t.Error("Get after Release did not reuse the first Int")
+	}
+	if len(p.chunks) != 2 {
+		t.Errorf("pool has %d chunks, want 2", len(p.chunks))
+	}
+	p.Free()
+	if z := p.Get().SetInt64(5); z.Int64() != 5 {
+		t.Errorf("Get after Free = %v, want 5", z)
+	}
+	p.Free()
+}
+
+func TestProgram(t *testing.T) {
+	var p Program
+	x, y, z, q, r := NewInt(1000), NewInt(7), new(Int), new(Int), new(Int)
+	rx, ry, rz, rq, rr := p.Reg(x), p.Reg(y), p.Reg(z), p.Reg(q), p.Reg(r)
+
+	p.Mul(rz, rx, ry)
+	p.AddMulInt64(rz, ry, -2)
+	p.Lsh(rz, rz, 1)
+	p.Sub(rz, rz, ry)
+	p.DivMod(rq, rr, rz, ry)
+	c := p.Cmp(rq, rx)
+	i := p.Int64(rr)
+	res, ok := p.Run()
+	// z = ((1000*7 - 2*7) << 1) - 7 = 13965 = 1995*7 + 0
+	if !ok || len(res) != 2 || z.Int64() != 13965 || q.Int64() != 1995 || res[c] != 1 || res[i] != 0 {
+		t.Errorf("Run = %v, %v, with z = %v, q = %v; want [1 0], true, with z = 13965, q = 1995", res, ok, z, q)
+	}
+
+	p.Reset()
+	p.SetInt64(rz, 5)
+	p.Int64(rz)
+	p.StopIfCmp(rz, ry, -1)
+	p.SetInt64(rz, 6)
+	res, ok = p.Run()
+	if ok || len(res) != 1 || res[0] != 5 || z.Int64() != 5 {
+		t.Errorf("Run with stop = %v, %v, with z = %v; want [5], false, with z = 5", res, ok, z)
+	}
+
+	var other Program
+	ro := other.Reg(new(Int))
+	for _, bad := range []Reg{{}, ro} {
+		func() {
+			defer func() {
+				if recover() == nil {
+					t.Errorf("Add with foreign register %v did not panic", bad)
+				}
+			}()
+			p.Add(rz, bad, rz)
+		}()
+	}
+}
+
+// fibSteps is how many Fibonacci numbers the Fib benchmarks compute
+// in each iteration.
+const fibSteps = 10000
+
+func BenchmarkFib(b *testing.B) {
+	calls := runtime.NumCgoCall()
+	for i := 0; i < b.N; i++ {
+		x, y := NewInt(0), NewInt(1)
+		for j := 0; j < fibSteps; j += 2 {
+			x.Add(x, y)
+			y.Add(y, x)
+		}
+	}
+	b.Logf("%.2f cgo calls per Fibonacci number", float64(runtime.NumCgoCall()-calls)/float64(b.N*fibSteps))
+}
+
+func BenchmarkFibProgram(b *testing.B) {
+	calls := runtime.NumCgoCall()
+	for i := 0; i < b.N; i++ {
+		var p Program
+		x, y := p.Reg(NewInt(0)), p.Reg(NewInt(1))
+		// The same program, of 100 steps, runs over and over.
+		for j := 0; j < 100; j += 2 {
+			p.Add(x, x, y)
+			p.Add(y, y, x)
+		}
+		for j := 0; j < fibSteps; j += 100 {
+			p.Run()
+		}
+	}
+	b.Logf("%.2f cgo calls per Fibonacci number", float64(runtime.NumCgoCall()-calls)/float64(b.N*fibSteps))
+}
+
+// benchTemporaries computes x*x + x in 100 temporaries made with
+// newInt, then lets them go with done, for each iteration.
+func benchTemporaries(b *testing.B, newInt func() *Int, done func(ts []*Int)) {
+	x := NewInt(1 << 40)
+	ts := make([]*Int, 100)
+	for i := 0; i < b.N; i++ {
+		for j := range ts {
+			z := newInt()
+			ts[j] = z.Mul(x, x).Add(z, x)
+		}
+		done(ts)
+	}
+}
+
+func BenchmarkTemporaries(b *testing.B) {
+	// What a finalizer would do for each Int.
+	benchTemporaries(b, func() *Int { return new(Int) }, func(ts []*Int) {
+		for _, z := range ts {
+			z.destroy()
+		}
+	})
+}
+
+func BenchmarkTemporariesPool(b *testing.B) {
+	var p Pool
+	benchTemporaries(b, p.Get, func([]*Int) { p.Release() })
+	p.Free()
+}
+
+// benchProgram builds a program for each iteration to run with args.
+func benchProgram(b *testing.B, build func(dir, prog string) *exec.Cmd, args ...string) {
+	dir, err := ioutil.TempDir("", "gmp")
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer os.RemoveAll(dir)
+	prog := filepath.Join(dir, "prog")
+	if out, err := build(dir, prog).CombinedOutput(); err != nil {
+		b.Fatalf("building: %v\n%s", err, out)
+	}
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if out, err := exec.Command(prog, args...).CombinedOutput(); err != nil {
+			b.Fatalf("%v\n%s", err, out)
+		}
+	}
+}
+
+func buildPi(dir, prog string) *exec.Cmd {
+	return exec.Command("go", "build", "-o", prog, "pi.go")
+}
+
+// The pi benchmarks compute 10000 digits of pi with pi.go
+// and with the C program it is based on.
+
+func BenchmarkPi(b *testing.B)      { benchProgram(b, buildPi, "-n", "10000") }
+func BenchmarkPiFused(b *testing.B) { benchProgram(b, buildPi, "-n", "10000", "-fused") }
+func BenchmarkPiBatch(b *testing.B) { benchProgram(b, buildPi, "-n", "10000", "-batch") }
+
+func BenchmarkPidigitsC(b *testing.B) {
+	benchProgram(b, func(dir, prog string) *exec.Cmd {
+		cc := os.Getenv("CC")
+		if cc == "" {
+			cc = "gcc"
+		}
+		return exec.Command(cc, "-O2", "-o", prog, "testdata/pidigits.c", "-lgmp")
+	}, "10000")
+}
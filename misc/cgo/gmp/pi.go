@@ -41,10 +41,17 @@ package main
 
 import (
 	big "."
+	"flag"
 	"fmt"
 	"runtime"
 )
 
+var (
+	n     = flag.Int("n", 1000, "print `n` digits")
+	fused = flag.Bool("fused", false, "use the fused operations, such as AddMulInt64")
+	batch = flag.Bool("batch", false, "run each term as a big.Program, with one cgo call")
+)
+
 var (
 	tmp1  = big.NewInt(0)
 	tmp2  = big.NewInt(0)
@@ -58,7 +65,11 @@ func extractDigit() int64 {
 	if big.CmpInt(numer, accum) > 0 {
 		return -1
 	}
-	tmp1.Lsh(numer, 1).Add(tmp1, numer).Add(tmp1, accum)
+	if *fused {
+		tmp1.Set(accum).AddMulInt64(numer, 3)
+	} else {
+		tmp1.Lsh(numer, 1).Add(tmp1, numer).Add(tmp1, accum)
+	}
 	big.DivModInt(tmp1, tmp2, tmp1, denom)
 	tmp2.Add(tmp2, numer)
 	if big.CmpInt(tmp2, denom) >= 0 {
@@ -69,6 +80,12 @@ func extractDigit() int64 {
 
 func nextTerm(k int64) {
 	y2 := k*2 + 1
+	if *fused {
+		accum.AddMulInt64(numer, 2).MulInt64(accum, y2)
+		numer.MulInt64(numer, k)
+		denom.MulInt64(denom, y2)
+		return
+	}
 	accum.Add(accum, tmp1.Lsh(numer, 1))
 	accum.Mul(accum, tmp1.SetInt64(y2))
 	numer.Mul(numer, tmp1.SetInt64(k))
@@ -76,31 +93,90 @@ func nextTerm(k int64) {
 }
 
 func eliminateDigit(d int64) {
+	if *fused {
+		accum.SubMulInt64(denom, d).MulInt64(accum, 10)
+		numer.MulInt64(numer, 10)
+		return
+	}
 	accum.Sub(accum, tmp1.Mul(denom, tmp1.SetInt64(d)))
 	accum.Mul(accum, ten)
 	numer.Mul(numer, ten)
 }
 
+// The registers of prog, with -batch.
+var (
+	prog                                 big.Program
+	rtmp1, rtmp2, rnumer, raccum, rdenom big.Reg
+	pending                              = int64(-1) // digit to eliminate
+)
+
+// nextDigitBatch computes the next digit as nextTerm and extractDigit
+// do, with a single call into gmp for each term.  Each program first
+// eliminates the previous digit, the first time it runs.
+func nextDigitBatch(k *int64) int64 {
+	for {
+		prog.Reset()
+		if pending >= 0 {
+			prog.SubMulInt64(raccum, rdenom, pending)
+			prog.MulInt64(raccum, raccum, 10)
+			prog.MulInt64(rnumer, rnumer, 10)
+			pending = -1
+		}
+		*k++
+		y2 := *k*2 + 1
+		prog.AddMulInt64(raccum, rnumer, 2)
+		prog.MulInt64(raccum, raccum, y2)
+		prog.MulInt64(rnumer, rnumer, *k)
+		prog.MulInt64(rdenom, rdenom, y2)
+
+		prog.StopIfCmp(rnumer, raccum, 1)
+		prog.Set(rtmp1, raccum)
+		prog.AddMulInt64(rtmp1, rnumer, 3)
+		prog.DivMod(rtmp1, rtmp2, rtmp1, rdenom)
+		prog.Add(rtmp2, rtmp2, rnumer)
+		prog.StopIfCmp(rtmp2, rdenom, 0)
+		d := prog.Int64(rtmp1)
+		if res, ok := prog.Run(); ok {
+			pending = res[d]
+			return res[d]
+		}
+	}
+}
+
 func main() {
+	flag.Parse()
+	if *batch {
+		rtmp1, rtmp2 = prog.Reg(tmp1), prog.Reg(tmp2)
+		rnumer, raccum, rdenom = prog.Reg(numer), prog.Reg(accum), prog.Reg(denom)
+	}
 	i := 0
 	k := int64(0)
 	for {
-		d := int64(-1)
-		for d < 0 {
-			k++
-			nextTerm(k)
-			d = extractDigit()
+		var d int64
+		if *batch {
+			d = nextDigitBatch(&k)
+		} else {
+			d = -1
+			for d < 0 {
+				k++
+				nextTerm(k)
+				d = extractDigit()
+			}
+			eliminateDigit(d)
 		}
-		eliminateDigit(d)
 		fmt.Printf("%c", d+'0')
 
 		if i++; i%50 == 0 {
 			fmt.Printf("\n")
-			if i >= 1000 {
-				break
-			}
+		}
+		if i >= *n {
+			break
 		}
 	}
 
-	fmt.Printf("\n%d calls; bit sizes: %d %d %d\n", runtime.NumCgoCall(), numer.Len(), accum.Len(), denom.Len())
+	if pending >= 0 {
+		eliminateDigit(pending)
+	}
+	calls := runtime.NumCgoCall()
+	fmt.Printf("\n%d calls (%.1f per digit); bit sizes: %d %d %d\n", calls, float64(calls)/float64(*n), numer.Len(), accum.Len(), denom.Len())
 }
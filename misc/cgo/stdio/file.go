@@ -19,9 +19,49 @@ package stdio
 #include <errno.h>
 
 char* greeting = "hello, world";
+
+// The Go strings and byte slices are passed as they are, without
+// a copy into C memory (see cmd/cgo's _GoString_ and _GoBytes_).
+
+static size_t writeString(FILE *f, _GoString_ s) {
+	return fwrite(_GoStringPtr(s), 1, _GoStringLen(s), f);
+}
+
+static size_t writeBytes(FILE *f, _GoBytes_ b) {
+	return fwrite(_GoBytesPtr(b), 1, _GoBytesLen(b), f);
+}
+
+static size_t readBytes(FILE *f, _GoBytes_ b) {
+	return fread(_GoBytesPtr(b), 1, _GoBytesLen(b), f);
+}
+
+// readLine reads a line, or as much of it as fits, into b,
+// returning its length, or -1 at end of file.
+static int readLine(FILE *f, _GoBytes_ b) {
+	char *p;
+	int c, n;
+
+	p = _GoBytesPtr(b);
+	for(n = 0; (size_t)n < _GoBytesLen(b); ) {
+		c = getc_unlocked(f);
+		if(c == EOF)
+			break;
+		p[n++] = c;
+		if(c == '\n')
+			break;
+	}
+	if(n == 0 && feof(f))
+		return -1;
+	return n;
+}
 */
 import "C"
-import "unsafe"
+
+import (
+	"errors"
+	"io"
+	"unsafe"
+)
 
 type File C.FILE
 
@@ -29,13 +69,79 @@ type File C.FILE
 // Stdout and stderr are too special to be a reliable test.
 //var  = C.environ
 
+// Fopen opens the named file with fopen.
+func Fopen(name, mode string) (*File, error) {
+	cname := C.CString(name)
+	defer C.free(unsafe.Pointer(cname))
+	cmode := C.CString(mode)
+	defer C.free(unsafe.Pointer(cmode))
+	f, err := C.fopen(cname, cmode)
+	if f == nil {
+		return nil, err
+	}
+	return (*File)(f), nil
+}
+
+// Close closes f with fclose.
+func (f *File) Close() error {
+	if _, err := C.fclose((*C.FILE)(f)); err != nil {
+		return err
+	}
+	return nil
+}
+
+// WriteString writes s to f, and flushes f so that the string
+// appears at once, as when threads take turns writing to stdout.
 func (f *File) WriteString(s string) {
-	p := C.CString(s)
-	C.fputs(p, (*C.FILE)(f))
-	C.free(unsafe.Pointer(p))
+	C.writeString((*C.FILE)(f), s)
 	f.Flush()
 }
 
+// Write writes b to f with a single fwrite, straight from b.
+// Unlike WriteString, it leaves flushing to the C library or to Flush.
+func (f *File) Write(b []byte) (int, error) {
+	n := int(C.writeBytes((*C.FILE)(f), b))
+	if n < len(b) {
+		return n, errors.New("stdio: fwrite failed")
+	}
+	return n, nil
+}
+
+// Read reads into b with a single fread, straight into b.
+func (f *File) Read(b []byte) (int, error) {
+	if len(b) == 0 {
+		return 0, nil
+	}
+	n := int(C.readBytes((*C.FILE)(f), b))
+	if n == 0 {
+		if C.ferror((*C.FILE)(f)) != 0 {
+			return 0, errors.New("stdio: fread failed")
+		}
+		return 0, io.EOF
+	}
+	return n, nil
+}
+
+// ReadLine reads a line, including its newline, into b and returns
+// its length.  A line longer than b is returned in several pieces.
+// At end of file, ReadLine returns io.EOF.
+func (f *File) ReadLine(b []byte) (int, error) {
+	n := int(C.readLine((*C.FILE)(f), b))
+	if n < 0 {
+		return 0, io.EOF
+	}
+	return n, nil
+}
+
+// ReadByte reads a byte with fgetc.
+func (f *File) ReadByte() (byte, error) {
+	c := C.fgetc((*C.FILE)(f))
+	if c == C.EOF {
+		return 0, io.EOF
+	}
+	return byte(c), nil
+}
+
 func (f *File) Flush() {
 	C.fflush((*C.FILE)(f))
 }
@@ -0,0 +1,198 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+package stdio
+
+import (
+	"bytes"
+	"flag"
+	"io"
+	"io/ioutil"
+	"os"
+	"testing"
+)
+
+var fileSize = flag.Int64("filesize", 1<<30, "size of the file the benchmarks read and write")
+
+// line is a line of the test file.
+var line = []byte("The quick brown fox jumps over the lazy dog, again and again.\n")
+
+func tempFile(t testing.TB) string {
+	f, err := ioutil.TempFile("", "stdio")
+	if err != nil {
+		t.Fatal(err)
+	}
+	f.Close()
+	return f.Name()
+}
+
+// writeLines writes size bytes of lines to name.
+func writeLines(t testing.TB, name string, size int64) {
+	f, err := Fopen(name, "w")
+	if err != nil {
+		t.Fatal(err)
+	}
+	chunk := bytes.Repeat(line, 1<<16/len(line))
+	for n := int64(0); n < size; n += int64(len(chunk)) {
+		b := chunk
+		if size-n < int64(len(b)) {
+			b = b[:size-n]
+		}
+		if _, err := f.Write(b); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if err := f.Close(); err != nil {
+		t.Fatal(err)
+	}
+}
+
+func TestReadWrite(t *testing.T) {
+	name := tempFile(t)
+	defer os.Remove(name)
+	const size = 100000
+	writeLines(t, name, size)
+	want := bytes.Repeat(line, size/len(line)+1)[:size]
+
+	for _, read := range []struct {
+		name string
+		f    func(f *File) []byte
+	}{
+		{"Read", func(f *File) []byte {
+			var out []byte
+			buf := make([]byte, 4096)
+			for {
+				n, err := f.Read(buf)
+				out = append(out, buf[:n]...)
+				if err == io.EOF {
+					return out
+				}
+			}
+		}},
+		{"ReadLine", func(f *File) []byte {
+			var out []byte
+			buf := make([]byte, 40)
+			for {
+				n, err := f.ReadLine(buf)
+				if err == io.EOF {
+					return out
+				}
+				out = append(out, buf[:n]...)
+			}
+		}},
+		{"ReadByte", func(f *File) []byte {
+			var out []byte
+			for {
+				c, err := f.ReadByte()
+				if err == io.EOF {
+					return out
+				}
+				out = append(out, c)
+			}
+		}},
+	} {
+		f, err := Fopen(name, "r")
+		if err != nil {
+			t.Fatal(err)
+		}
+		if got := read.f(f); !bytes.Equal(got, want) {
+			t.Errorf("%s read %d bytes, not the %d written", read.name, len(got), len(want))
+		}
+		f.Close()
+	}
+
+	if _, err := Fopen(name+".missing", "r"); err == nil {
+		t.Error("Fopen of missing file succeeded")
+	}
+}
+
+// benchRead reads a file of -filesize bytes with read for each iteration.
+func benchRead(b *testing.B, read func(f *File)) {
+	name := tempFile(b)
+	defer os.Remove(name)
+	writeLines(b, name, *fileSize)
+	b.SetBytes(*fileSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		f, err := Fopen(name, "r")
+		if err != nil {
+			b.Fatal(err)
+		}
+		read(f)
+		f.Close()
+	}
+}
+
+func BenchmarkReadByte(b *testing.B) {
+	benchRead(b, func(f *File) {
+		for {
+			if _, err := f.ReadByte(); err != nil {
+				return
+			}
+		}
+	})
+}
+
+func BenchmarkReadLine(b *testing.B) {
+	buf := make([]byte, 1024)
+	benchRead(b, func(f *File) {
+		for {
+			if _, err := f.ReadLine(buf); err != nil {
+				return
+			}
+		}
+	})
+}
+
+func BenchmarkRead(b *testing.B) {
+	buf := make([]byte, 1<<16)
+	benchRead(b, func(f *File) {
+		for {
+			if _, err := f.Read(buf); err != nil {
+				return
+			}
+		}
+	})
+}
+
+// benchWrite writes a file of -filesize bytes with write for each iteration.
+func benchWrite(b *testing.B, write func(f *File)) {
+	name := tempFile(b)
+	defer os.Remove(name)
+	b.SetBytes(*fileSize)
+	for i := 0; i < b.N; i++ {
+		f, err := Fopen(name, "w")
+		if err != nil {
+			b.Fatal(err)
+		}
+		write(f)
+		f.Close()
+	}
+}
+
+func BenchmarkWriteString(b *testing.B) {
+	s := string(line)
+	benchWrite(b, func(f *File) {
+		for n := int64(0); n < *fileSize; n += int64(len(s)) {
+			f.WriteString(s)
+		}
+	})
+}
+
+func BenchmarkWriteLine(b *testing.B) {
+	benchWrite(b, func(f *File) {
+		for n := int64(0); n < *fileSize; n += int64(len(line)) {
+			f.Write(line)
+		}
+	})
+}
+
+func BenchmarkWrite(b *testing.B) {
+	chunk := bytes.Repeat(line, 1<<16/len(line))
+	benchWrite(b, func(f *File) {
+		for n := int64(0); n < *fileSize; n += int64(len(chunk)) {
+			f.Write(chunk)
+		}
+	})
+}
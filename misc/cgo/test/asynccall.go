@@ -0,0 +1,115 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for C.CallAsync.
+
+package cgotest
+
+/*
+#include <stdlib.h>
+#include <unistd.h>
+
+struct asyncJob { long in; long out; };
+
+static struct asyncJob *newAsyncJobs(int n) { return calloc(n, sizeof(struct asyncJob)); }
+
+// asyncWork spins for about a microsecond.
+void asyncWork(void *p) {
+	struct asyncJob *j = p;
+	volatile long i, x;
+
+	x = j->in;
+	for(i = 0; i < 500; i++)
+		x = x*31 + i;
+	j->out = j->in*2 + (x&0);
+}
+
+void asyncSleep(void *p) {
+	usleep(1000);
+	((struct asyncJob*)p)->out = 1;
+}
+*/
+import "C"
+
+import (
+	"testing"
+	"time"
+	"unsafe"
+)
+
+const asyncCalls = 10000
+
+func asyncJobs(n int) []C.struct_asyncJob {
+	p := C.newAsyncJobs(C.int(n))
+	return (*[1 << 24]C.struct_asyncJob)(unsafe.Pointer(p))[:n:n]
+}
+
+func testCallAsync(t *testing.T) {
+	jobs := asyncJobs(asyncCalls)
+	defer C.free(unsafe.Pointer(&jobs[0]))
+	done := make([]<-chan struct{}, len(jobs))
+	for i := range jobs {
+		jobs[i].in = C.long(i)
+		done[i] = C.CallAsync((*[0]byte)(C.asyncWork), unsafe.Pointer(&jobs[i]))
+	}
+	for i, d := range done {
+		<-d
+		if jobs[i].out != C.long(2*i) {
+			t.Fatalf("job %d: out = %d, want %d", i, jobs[i].out, 2*i)
+		}
+	}
+
+	// Calls that block finish too, whatever the size of the pool.
+	sleep := asyncJobs(64)
+	defer C.free(unsafe.Pointer(&sleep[0]))
+	for i := range sleep {
+		d := C.CallAsync((*[0]byte)(C.asyncSleep), unsafe.Pointer(&sleep[i]))
+		done[i] = d
+	}
+	timeout := time.After(10 * time.Second)
+	for i := range sleep {
+		select {
+		case <-done[i]:
+		case <-timeout:
+			t.Fatalf("asyncSleep call %d did not finish", i)
+		}
+		if sleep[i].out != 1 {
+			t.Fatalf("asyncSleep call %d: out = %d, want 1", i, sleep[i].out)
+		}
+	}
+}
+
+// benchAsyncCalls runs asyncCalls calls to asyncWork, all in flight at once,
+// for each iteration.
+func benchAsyncCalls(b *testing.B, call func(j *C.struct_asyncJob) <-chan struct{}) {
+	jobs := asyncJobs(asyncCalls)
+	defer C.free(unsafe.Pointer(&jobs[0]))
+	done := make([]<-chan struct{}, len(jobs))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j := range jobs {
+			done[j] = call(&jobs[j])
+		}
+		for _, d := range done {
+			<-d
+		}
+	}
+}
+
+func benchCallAsync(b *testing.B) {
+	benchAsyncCalls(b, func(j *C.struct_asyncJob) <-chan struct{} {
+		return C.CallAsync((*[0]byte)(C.asyncWork), unsafe.Pointer(j))
+	})
+}
+
+func benchCallAsyncGoroutines(b *testing.B) {
+	benchAsyncCalls(b, func(j *C.struct_asyncJob) <-chan struct{} {
+		d := make(chan struct{})
+		go func() {
+			C.asyncWork(unsafe.Pointer(j))
+			close(d)
+		}()
+		return d
+	})
+}
@@ -12,6 +12,7 @@ void callPanic(void);
 int callGoReturnVal(void);
 int returnAfterGrow(void);
 int returnAfterGrowFromGo(void);
+int returnAfterPreGrow(void);
 */
 import "C"
 
@@ -234,6 +235,34 @@ func testReturnAfterGrowFromGo(t *testing.T) {
 	}
 }
 
+// Test that a callback exported with a stack size gets it.
+func testReturnAfterPreGrow(t *testing.T) {
+	// Use a new goroutine so that we get a small stack.
+	c := make(chan int)
+	go func() {
+		c <- int(C.returnAfterPreGrow())
+	}()
+	if got, want := <-c, 129*128/2; got != want {
+		t.Errorf("got %d want %d", got, want)
+	}
+}
+
+// Calls from new goroutines, which start with small stacks,
+// into C and back into Go functions that need a lot of stack.
+func benchCallbackGrow(b *testing.B, pregrow bool) {
+	c := make(chan int)
+	for i := 0; i < b.N; i++ {
+		go func() {
+			if pregrow {
+				c <- int(C.returnAfterPreGrow())
+			} else {
+				c <- int(C.returnAfterGrowFromGo())
+			}
+		}()
+		<-c
+	}
+}
+
 //export goReturnVal
 func goReturnVal() (r C.int) {
 	// Force a stack copy.
@@ -250,6 +279,12 @@ func goReturnVal() (r C.int) {
 	return
 }
 
+// goReturnValStack is goReturnVal, exported with the stack it needs.
+//export goReturnValStack stack=64K
+func goReturnValStack() C.int {
+	return goReturnVal()
+}
+
 func testCallbackStack(t *testing.T) {
 	// Make cgo call and callback with different amount of stack stack available.
 	// We do not do any explicit checks, just ensure that it does not crash.
@@ -80,3 +80,10 @@ returnAfterGrowFromGo(void)
 	return goReturnVal();
 }
 
+int
+returnAfterPreGrow(void)
+{
+	extern int goReturnValStack(void);
+	return goReturnValStack();
+}
+
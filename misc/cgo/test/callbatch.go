@@ -0,0 +1,106 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for batched calls into C with C.CallBatch.
+
+package cgotest
+
+/*
+static long long callBatchTotal;
+
+void callBatchAdd(void *arg) {
+	callBatchTotal = callBatchTotal*10 + *(int*)arg;
+}
+
+long long callBatchResult(void) {
+	long long r = callBatchTotal;
+	callBatchTotal = 0;
+	return r;
+}
+
+void callback(void *f);
+*/
+import "C"
+
+import (
+	"testing"
+	"unsafe"
+)
+
+func testCallBatch(t *testing.T) {
+	args := []C.int{1, 2, 3, 4, 5}
+	calls := make([]C._CgoCall_, len(args))
+	for i := range calls {
+		calls[i].fn = (*[0]byte)(C.callBatchAdd)
+		calls[i].arg = unsafe.Pointer(&args[i])
+	}
+	C.CallBatch(&calls[0], C.int(len(calls)))
+	if got, want := C.callBatchResult(), C.longlong(12345); got != want {
+		t.Errorf("CallBatch ran calls as %d, want %d", got, want)
+	}
+
+	// An empty batch does nothing.
+	C.CallBatch(&calls[0], 0)
+	if got := C.callBatchResult(); got != 0 {
+		t.Errorf("empty CallBatch ran calls: %d", got)
+	}
+}
+
+// Test that a callback into Go from the middle of a batch works,
+// even when it grows the goroutine stack.
+func testCallBatchCallback(t *testing.T) {
+	c := make(chan int)
+	go func() {
+		n := 0
+		f := func() {
+			var grow func(int) int
+			grow = func(i int) int {
+				var buf [256]byte
+				use(buf[:])
+				if i == 0 {
+					return 0
+				}
+				return 1 + grow(i-1)
+			}
+			n += grow(128)
+		}
+		one := C.int(1)
+		calls := []C._CgoCall_{
+			{(*[0]byte)(C.callBatchAdd), unsafe.Pointer(&one)},
+			{(*[0]byte)(C.callback), *(*unsafe.Pointer)(unsafe.Pointer(&f))},
+			{(*[0]byte)(C.callBatchAdd), unsafe.Pointer(&one)},
+		}
+		C.CallBatch(&calls[0], C.int(len(calls)))
+		c <- n
+	}()
+	if got, want := <-c, 128; got != want {
+		t.Errorf("callback in batch returned %d, want %d", got, want)
+	}
+	if got, want := C.callBatchResult(), C.longlong(11); got != want {
+		t.Errorf("CallBatch ran calls as %d, want %d", got, want)
+	}
+}
+
+func benchCallBatch(b *testing.B, size int) {
+	arg := C.int(1)
+	if size == 0 {
+		// Unbatched: one full cgo call per C call.
+		for i := 0; i < b.N; i++ {
+			C.callBatchAdd(unsafe.Pointer(&arg))
+		}
+		return
+	}
+	calls := make([]C._CgoCall_, size)
+	for i := range calls {
+		calls[i].fn = (*[0]byte)(C.callBatchAdd)
+		calls[i].arg = unsafe.Pointer(&arg)
+	}
+	for i := 0; i < b.N; i += size {
+		n := size
+		if b.N-i < n {
+			n = b.N - i
+		}
+		C.CallBatch(&calls[0], C.int(n))
+	}
+}
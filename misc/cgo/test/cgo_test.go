@@ -61,9 +61,55 @@ func Test8517(t *testing.T)                  { test8517(t) }
 func Test8811(t *testing.T)                  { test8811(t) }
 func TestReturnAfterGrow(t *testing.T)       { testReturnAfterGrow(t) }
 func TestReturnAfterGrowFromGo(t *testing.T) { testReturnAfterGrowFromGo(t) }
+func TestReturnAfterPreGrow(t *testing.T)    { testReturnAfterPreGrow(t) }
 func Test9026(t *testing.T)                  { test9026(t) }
 func Test9557(t *testing.T)                  { test9557(t) }
 func Test10303(t *testing.T)                 { test10303(t, 10) }
 func Test11925(t *testing.T)                 { test11925(t) }
+func TestCallBatch(t *testing.T)             { testCallBatch(t) }
+func TestCallBatchCallback(t *testing.T)     { testCallBatchCallback(t) }
+func TestLeaf(t *testing.T)                  { testLeaf(t) }
+func TestCMalloc(t *testing.T)               { testCMalloc(t) }
+func TestCMallocStats(t *testing.T)          { testCMallocStats(t) }
+func TestGoStringArg(t *testing.T)           { testGoStringArg(t) }
+func TestGoBytesInto(t *testing.T)           { testGoBytesInto(t) }
+func TestGoBytesVec(t *testing.T)            { testGoBytesVec(t) }
+func TestScalarCall(t *testing.T)            { testScalarCall(t) }
+func TestErrnoResult(t *testing.T)           { testErrnoResult(t) }
+func TestCopyStructs(t *testing.T)           { testCopyStructs(t) }
+func TestCallAsync(t *testing.T)             { testCallAsync(t) }
 
-func BenchmarkCgoCall(b *testing.B) { benchCgoCall(b) }
+func BenchmarkCgoCall(b *testing.B)                    { benchCgoCall(b) }
+func BenchmarkCgoCallLeaf(b *testing.B)                { benchCgoCallLeaf(b) }
+func BenchmarkCallBatchNone(b *testing.B)              { benchCallBatch(b, 0) }
+func BenchmarkCallBatch16(b *testing.B)                { benchCallBatch(b, 16) }
+func BenchmarkCallBatch256(b *testing.B)               { benchCallBatch(b, 256) }
+func BenchmarkCString(b *testing.B)                    { benchCString(b) }
+func BenchmarkCStringArg(b *testing.B)                 { benchCStringArg(b) }
+func BenchmarkGoStringArg(b *testing.B)                { benchGoStringArg(b) }
+func BenchmarkGoStringArgNUL(b *testing.B)             { benchGoStringArgNUL(b) }
+func BenchmarkCthread1(b *testing.B)                   { benchCthread(b, 1, 1000) }
+func BenchmarkCthread8(b *testing.B)                   { benchCthread(b, 8, 1000) }
+func BenchmarkCthread64(b *testing.B)                  { benchCthread(b, 64, 1000) }
+func BenchmarkCallbackGrow(b *testing.B)               { benchCallbackGrow(b, false) }
+func BenchmarkCallbackPreGrow(b *testing.B)            { benchCallbackGrow(b, true) }
+func BenchmarkGoBytes(b *testing.B)                    { benchGoBytes(b) }
+func BenchmarkGoBytesInto(b *testing.B)                { benchGoBytesInto(b) }
+func BenchmarkGoBytesVec(b *testing.B)                 { benchGoBytesVec(b) }
+func BenchmarkScalarInt1(b *testing.B)                 { benchScalarInt1(b) }
+func BenchmarkScalarInt6(b *testing.B)                 { benchScalarInt6(b) }
+func BenchmarkScalarInt6Leaf(b *testing.B)             { benchScalarInt6Leaf(b) }
+func BenchmarkScalarInt8(b *testing.B)                 { benchScalarInt8(b) }
+func BenchmarkScalarDouble2(b *testing.B)              { benchScalarDouble2(b) }
+func BenchmarkScalarMixed(b *testing.B)                { benchScalarMixed(b) }
+func BenchmarkScalarMixedLeaf(b *testing.B)            { benchScalarMixedLeaf(b) }
+func BenchmarkScalarStruct(b *testing.B)               { benchScalarStruct(b) }
+func BenchmarkMostlyOK(b *testing.B)                   { benchMostlyOK(b) }
+func BenchmarkMostlyOKErrno(b *testing.B)              { benchMostlyOKErrno(b) }
+func BenchmarkStructArrayPerElem(b *testing.B)         { benchStructArrayPerElem(b) }
+func BenchmarkStructArrayCopyToC(b *testing.B)         { benchStructArrayCopyToC(b) }
+func BenchmarkStructArrayCopyToCGather(b *testing.B)   { benchStructArrayCopyToCGather(b) }
+func BenchmarkStructArrayCopyToGo(b *testing.B)        { benchStructArrayCopyToGo(b) }
+func BenchmarkStructArrayCopyToGoScatter(b *testing.B) { benchStructArrayCopyToGoScatter(b) }
+func BenchmarkCallAsync(b *testing.B)                  { benchCallAsync(b) }
+func BenchmarkCallAsyncGoroutines(b *testing.B)        { benchCallAsyncGoroutines(b) }
@@ -0,0 +1,98 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for C.malloc, C.CString and C.free, which go through
+// a per-thread cache in the runtime.
+
+package cgotest
+
+/*
+#include <stdlib.h>
+#include <string.h>
+
+static int cmallocCheck(char *p, int n) {
+	int i;
+
+	for(i = 0; i < n; i++)
+		if(p[i] != (char)i)
+			return 0;
+	return 1;
+}
+
+static void *cmallocFromC(int n) {
+	return malloc(n);
+}
+
+static void cmallocFreeFromC(void *p) {
+	free(p);
+}
+*/
+import "C"
+
+import (
+	"os"
+	"strings"
+	"testing"
+	"unsafe"
+)
+
+func testCMalloc(t *testing.T) {
+	// Fill enough blocks of each size to go through
+	// several refills and drains of the cache.
+	for _, n := range []int{0, 1, 16, 17, 100, 256, 257, 4096} {
+		var ps []unsafe.Pointer
+		for i := 0; i < 100; i++ {
+			p := C.malloc(C.size_t(n))
+			b := (*[1 << 20]byte)(p)[:n:n]
+			for j := range b {
+				b[j] = byte(j)
+			}
+			ps = append(ps, p)
+		}
+		for _, p := range ps {
+			if C.cmallocCheck((*C.char)(p), C.int(n)) == 0 {
+				t.Fatalf("C.malloc(%d) returned overlapping blocks", n)
+			}
+			C.free(p)
+		}
+	}
+
+	// Blocks may cross between C and the runtime in either direction.
+	C.cmallocFreeFromC(C.malloc(32))
+	C.free(C.cmallocFromC(32))
+	C.free(nil)
+}
+
+func testCMallocStats(t *testing.T) {
+	hits0, misses0, frees0, drains0, ok := cmallocStats()
+	if !ok {
+		t.Skip("C allocation cache statistics not available")
+	}
+	if strings.Contains(os.Getenv("GODEBUG"), "cgomalloccacheoff=1") {
+		t.Skip("C allocation cache turned off")
+	}
+	const n = 10000
+	for i := 0; i < n; i++ {
+		C.free(unsafe.Pointer(C.CString("hello, world")))
+	}
+	hits, misses, frees, drains, _ := cmallocStats()
+	hits -= hits0
+	misses -= misses0
+	frees -= frees0
+	drains -= drains0
+	// Other goroutines may use the cache too, so only check
+	// that almost all of our calls stayed in Go.
+	if hits+misses < n || frees < n {
+		t.Fatalf("cache saw %d mallocs, %d frees; want at least %d", hits+misses, frees, n)
+	}
+	if misses > n/10 || drains > n/10 {
+		t.Errorf("%d mallocs, %d frees: %d malloc misses, %d free drains; want at most %d", hits+misses, frees, misses, drains, n/10)
+	}
+}
+
+func benchCString(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.free(unsafe.Pointer(C.CString("hello, world")))
+	}
+}
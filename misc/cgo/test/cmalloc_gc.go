@@ -0,0 +1,17 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// +build gc
+
+package cgotest
+
+import _ "unsafe"
+
+//go:linkname runtime_cmallocstats runtime.cmallocstats
+func runtime_cmallocstats() (hits, misses, frees, drains uint64)
+
+func cmallocStats() (hits, misses, frees, drains uint64, ok bool) {
+	hits, misses, frees, drains = runtime_cmallocstats()
+	return hits, misses, frees, drains, true
+}
@@ -0,0 +1,12 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// +build gccgo
+
+package cgotest
+
+// The gccgo runtime does not cache C allocations.
+func cmallocStats() (hits, misses, frees, drains uint64, ok bool) {
+	return 0, 0, 0, 0, false
+}
@@ -5,6 +5,7 @@
 package cgotest
 
 // extern void doAdd(int, int);
+// extern void doCalls(int, int);
 import "C"
 
 import (
@@ -29,6 +30,10 @@ func Add(x int) {
 	*p = 2
 }
 
+//export cthreadNop
+func cthreadNop() {
+}
+
 func testCthread(t *testing.T) {
 	sum.i = 0
 	C.doAdd(10, 6)
@@ -38,3 +43,11 @@ func testCthread(t *testing.T) {
 		t.Fatalf("sum=%d, want %d", sum.i, want)
 	}
 }
+
+// benchCthread measures calls into Go from nthread C threads at once,
+// each making ncall calls. Each op is one call.
+func benchCthread(b *testing.B, nthread, ncall int) {
+	for i := 0; i < b.N; i += nthread * ncall {
+		C.doCalls(C.int(ncall), C.int(nthread))
+	}
+}
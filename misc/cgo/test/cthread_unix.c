@@ -18,6 +18,32 @@ addThread(void *p)
 	return 0;
 }
 
+static void*
+callThread(void *p)
+{
+	int i, n;
+
+	n = *(int*)p;
+	for(i=0; i<n; i++)
+		cthreadNop();
+	return 0;
+}
+
+void
+doCalls(int ncall, int nthread)
+{
+	enum { MaxThread = 64 };
+	int i;
+	pthread_t thread_id[MaxThread];
+
+	if(nthread > MaxThread)
+		nthread = MaxThread;
+	for(i=0; i<nthread; i++)
+		pthread_create(&thread_id[i], 0, callThread, &ncall);
+	for(i=0; i<nthread; i++)
+		pthread_join(thread_id[i], 0);
+}
+
 void
 doAdd(int max, int nthread)
 {
@@ -19,6 +19,35 @@ addThread(void *p)
 	return 0;
 }
 
+__stdcall
+static unsigned int
+callThread(void *p)
+{
+	int i, n;
+
+	n = *(int*)p;
+	for(i=0; i<n; i++)
+		cthreadNop();
+	return 0;
+}
+
+void
+doCalls(int ncall, int nthread)
+{
+	enum { MaxThread = 64 };
+	int i;
+	uintptr_t thread_id[MaxThread];
+
+	if(nthread > MaxThread)
+		nthread = MaxThread;
+	for(i=0; i<nthread; i++)
+		thread_id[i] = _beginthreadex(0, 0, callThread, &ncall, 0, 0);
+	for(i=0; i<nthread; i++) {
+		WaitForSingleObject((HANDLE)thread_id[i], INFINITE);
+		CloseHandle((HANDLE)thread_id[i]);
+	}
+}
+
 void
 doAdd(int max, int nthread)
 {
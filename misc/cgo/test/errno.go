@@ -0,0 +1,108 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for C functions declared with #cgo errno:,
+// which report failure by their result.
+
+package cgotest
+
+/*
+#cgo errno: mostlyOKErrno mostlyOKPtr mostlyOKSize
+#include <errno.h>
+#include <stddef.h>
+
+// mostlyOK fails with EINVAL for one call in a thousand.
+static int mostlyOK(int i) {
+	if(i%1000 == 0) {
+		errno = EINVAL;
+		return -1;
+	}
+	return i;
+}
+
+static int mostlyOKErrno(int i) {
+	if(i%1000 == 0) {
+		errno = EINVAL;
+		return -1;
+	}
+	return i;
+}
+
+// mostlyOKSize fails as functions returning size_t do,
+// with (size_t)-1.
+static size_t mostlyOKSize(int i) {
+	if(i%1000 == 0) {
+		errno = EINVAL;
+		return (size_t)-1;
+	}
+	return i;
+}
+
+static char okByte;
+
+static char *mostlyOKPtr(int i) {
+	if(i%1000 == 0) {
+		errno = ERANGE;
+		return NULL;
+	}
+	return &okByte;
+}
+
+// okStaleErrno succeeds but leaves errno set, as C library
+// functions are allowed to.
+static long okStaleErrno(void) {
+	errno = EBADF;
+	return 0;
+}
+*/
+import "C"
+
+import (
+	"syscall"
+	"testing"
+)
+
+func testErrnoResult(t *testing.T) {
+	if n, err := C.mostlyOKErrno(1); n != 1 || err != nil {
+		t.Errorf("mostlyOKErrno(1) = %d, %v, want 1, nil", n, err)
+	}
+	if n, err := C.mostlyOKErrno(1000); n != -1 || err != syscall.EINVAL {
+		t.Errorf("mostlyOKErrno(1000) = %d, %v, want -1, %v", n, err, syscall.EINVAL)
+	}
+	if n, err := C.mostlyOKSize(1); n != 1 || err != nil {
+		t.Errorf("mostlyOKSize(1) = %d, %v, want 1, nil", n, err)
+	}
+	if n, err := C.mostlyOKSize(1000); n != ^C.size_t(0) || err != syscall.EINVAL {
+		t.Errorf("mostlyOKSize(1000) = %d, %v, want %d, %v", n, err, ^C.size_t(0), syscall.EINVAL)
+	}
+	if p, err := C.mostlyOKPtr(1); p == nil || err != nil {
+		t.Errorf("mostlyOKPtr(1) = %p, %v, want non-nil, nil", p, err)
+	}
+	if p, err := C.mostlyOKPtr(0); p != nil || err != syscall.ERANGE {
+		t.Errorf("mostlyOKPtr(0) = %p, %v, want nil, %v", p, err, syscall.ERANGE)
+	}
+
+	// A stale errno from an earlier call must not be reported
+	// for a call that succeeds.
+	C.okStaleErrno()
+	if n, err := C.mostlyOKErrno(2); n != 2 || err != nil {
+		t.Errorf("mostlyOKErrno(2) after stale errno = %d, %v, want 2, nil", n, err)
+	}
+}
+
+func benchMostlyOK(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		if _, err := C.mostlyOK(C.int(i)); err != nil && i%1000 != 0 {
+			b.Fatal(err)
+		}
+	}
+}
+
+func benchMostlyOKErrno(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		if _, err := C.mostlyOKErrno(C.int(i)); err != nil && i%1000 != 0 {
+			b.Fatal(err)
+		}
+	}
+}
@@ -0,0 +1,144 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for copying C memory into existing Go buffers
+// with C.GoBytesInto and C.GoBytesVec.
+
+package cgotest
+
+/*
+enum { ringSize = 64*256 };
+static char ring[ringSize];
+
+static char *ringBase(void) { return ring; }
+
+// ringFill sets ring to a pattern and describes n chunks of it in bufs.
+static void ringFill(_CgoBuf_ *bufs, int n, size_t size) {
+	int i;
+
+	for(i = 0; i < sizeof ring; i++)
+		ring[i] = i%251;
+	for(i = 0; i < n; i++) {
+		bufs[i].p = ring + i*size;
+		bufs[i].n = size;
+	}
+}
+*/
+import "C"
+
+import (
+	"bytes"
+	"testing"
+	"unsafe"
+)
+
+// ringBytes returns the contents of the C ring, as ringFill sets it.
+func ringBytes() []byte {
+	return C.GoBytes(unsafe.Pointer(C.ringBase()), C.ringSize)
+}
+
+func testGoBytesInto(t *testing.T) {
+	bufs := make([]C._CgoBuf_, 1)
+	C.ringFill(&bufs[0], 1, 0)
+	want := ringBytes()
+	p := unsafe.Pointer(C.ringBase())
+
+	for _, tt := range []struct{ len, n, want int }{
+		{10, 5, 5},
+		{5, 10, 5},
+		{0, 10, 0},
+		{10, 0, 0},
+		{10, -1, 0},
+	} {
+		dst := make([]byte, tt.len)
+		got := C.GoBytesInto(dst, p, C.int(tt.n))
+		if int(got) != tt.want {
+			t.Errorf("GoBytesInto(len %d, n %d) = %d, want %d", tt.len, tt.n, got, tt.want)
+		}
+		if !bytes.Equal(dst[:tt.want], want[:tt.want]) {
+			t.Errorf("GoBytesInto(len %d, n %d) copied %v, want %v", tt.len, tt.n, dst[:tt.want], want[:tt.want])
+		}
+	}
+	if got := C.GoBytesInto(nil, nil, 0); got != 0 {
+		t.Errorf("GoBytesInto(nil, nil, 0) = %d, want 0", got)
+	}
+}
+
+func testGoBytesVec(t *testing.T) {
+	const nchunk, size = 8, 16
+	bufs := make([]C._CgoBuf_, nchunk)
+	C.ringFill(&bufs[0], nchunk, size)
+	want := ringBytes()
+
+	// Buffers shorter than, as long as and longer than the chunks.
+	dst := make([][]byte, nchunk)
+	total := 0
+	for i := range dst {
+		dst[i] = make([]byte, i*4)
+		if i*4 < size {
+			total += i * 4
+		} else {
+			total += size
+		}
+	}
+	if got := C.GoBytesVec(&dst[0], &bufs[0], nchunk); int(got) != total {
+		t.Errorf("GoBytesVec = %d, want %d", got, total)
+	}
+	for i, d := range dst {
+		n := i * 4
+		if n > size {
+			n = size
+		}
+		if w := want[i*size : i*size+n]; !bytes.Equal(d, w) {
+			t.Errorf("GoBytesVec: dst[%d] = %v, want %v", i, d, w)
+		}
+	}
+}
+
+const benchChunks, benchChunkSize = 64, 256
+
+func benchGoBytes(b *testing.B) {
+	bufs := make([]C._CgoBuf_, benchChunks)
+	C.ringFill(&bufs[0], benchChunks, benchChunkSize)
+	b.SetBytes(benchChunks * benchChunkSize)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for _, buf := range bufs {
+			C.GoBytes(buf.p, C.int(buf.n))
+		}
+	}
+}
+
+func benchGoBytesInto(b *testing.B) {
+	bufs := make([]C._CgoBuf_, benchChunks)
+	C.ringFill(&bufs[0], benchChunks, benchChunkSize)
+	dst := make([]byte, benchChunkSize)
+	b.SetBytes(benchChunks * benchChunkSize)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for _, buf := range bufs {
+			C.GoBytesInto(dst, buf.p, C.int(buf.n))
+		}
+	}
+}
+
+func benchGoBytesVec(b *testing.B) {
+	bufs := make([]C._CgoBuf_, benchChunks)
+	C.ringFill(&bufs[0], benchChunks, benchChunkSize)
+	dst := make([][]byte, benchChunks)
+	for i := range dst {
+		dst[i] = make([]byte, benchChunkSize)
+	}
+	b.SetBytes(benchChunks * benchChunkSize)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j := range dst {
+			dst[j] = dst[j][:cap(dst[j])]
+		}
+		C.GoBytesVec(&dst[0], &bufs[0], benchChunks)
+	}
+}
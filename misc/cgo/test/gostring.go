@@ -0,0 +1,118 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for passing Go strings and byte slices to C
+// as _GoString_ and _GoBytes_, without copying them.
+
+package cgotest
+
+/*
+#include <stdlib.h>
+#include <string.h>
+
+static size_t goStringLen(_GoString_ s) {
+	return _GoStringLen(s);
+}
+
+static int goStringByte(_GoString_ s, int i) {
+	return (unsigned char)_GoStringPtr(s)[i];
+}
+
+// Returns strlen of s copied to a C string, using a buffer of
+// size bytes on the C stack when s fits.
+static size_t goStringToC(_GoString_ s, int size) {
+	char buf[64];
+	char *p;
+	size_t n;
+
+	p = _GoStringToC(s, buf, size);
+	if(p == NULL)
+		return (size_t)-1;
+	n = strlen(p);
+	if(p != buf)
+		free(p);
+	return n;
+}
+
+static void goBytesFill(_GoBytes_ b, int c) {
+	memset(_GoBytesPtr(b), c, _GoBytesLen(b));
+}
+
+static size_t cStringArg(char *s) {
+	return strlen(s);
+}
+
+static size_t goStringArg(_GoString_ s) {
+	return _GoStringLen(s);
+}
+
+static size_t goStringArgNUL(_GoString_ s) {
+	char buf[64];
+	char *p;
+	size_t n;
+
+	p = _GoStringToC(s, buf, sizeof buf);
+	n = strlen(p);
+	if(p != buf)
+		free(p);
+	return n;
+}
+*/
+import "C"
+
+import (
+	"testing"
+	"unsafe"
+)
+
+func testGoStringArg(t *testing.T) {
+	s := "hello, world"
+	if n := C.goStringLen(s); n != C.size_t(len(s)) {
+		t.Errorf("_GoStringLen(%q) = %d", s, n)
+	}
+	for i := 0; i < len(s); i++ {
+		if c := C.goStringByte(s, C.int(i)); c != C.int(s[i]) {
+			t.Errorf("_GoStringPtr(%q)[%d] = %q", s, i, c)
+		}
+	}
+	if n := C.goStringLen(""); n != 0 {
+		t.Errorf("_GoStringLen(\"\") = %d", n)
+	}
+
+	// _GoStringToC uses the buffer only when s and its NUL fit.
+	for _, size := range []int{0, len(s), len(s) + 1, 64} {
+		if n := C.goStringToC(s, C.int(size)); n != C.size_t(len(s)) {
+			t.Errorf("_GoStringToC(%q) with %d-byte buffer: strlen = %d", s, size, int(n))
+		}
+	}
+
+	// C may write to the Go memory of a []byte.
+	b := make([]byte, 10)
+	C.goBytesFill(b[2:5], 'x')
+	if string(b) != "\x00\x00xxx\x00\x00\x00\x00\x00" {
+		t.Errorf("_GoBytes_ fill: got %q", b)
+	}
+}
+
+var benchStrings = []string{"short", "a log line of a more typical length for a shipper to send on"}
+
+func benchCStringArg(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		p := C.CString(benchStrings[i&1])
+		C.cStringArg(p)
+		C.free(unsafe.Pointer(p))
+	}
+}
+
+func benchGoStringArg(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.goStringArg(benchStrings[i&1])
+	}
+}
+
+func benchGoStringArgNUL(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.goStringArgNUL(benchStrings[i&1])
+	}
+}
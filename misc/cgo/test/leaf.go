@@ -0,0 +1,45 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for C leaf functions (#cgo leaf:).
+
+package cgotest
+
+/*
+#cgo leaf: leafAdd leafSetErrno
+#include <errno.h>
+
+int leafAdd(int x, int y) {
+	return x+y;
+}
+
+int leafSetErrno(int e) {
+	errno = e;
+	return -1;
+}
+*/
+import "C"
+
+import (
+	"syscall"
+	"testing"
+)
+
+func testLeaf(t *testing.T) {
+	if got, want := C.leafAdd(2, 3), C.int(5); got != want {
+		t.Errorf("leafAdd(2, 3) = %d, want %d", got, want)
+	}
+	r, err := C.leafSetErrno(C.int(syscall.EINVAL))
+	if r != -1 || err != syscall.EINVAL {
+		t.Errorf("leafSetErrno(EINVAL) = %d, %v, want -1, %v", r, err, syscall.EINVAL)
+	}
+}
+
+func benchCgoCallLeaf(b *testing.B) {
+	const x = C.int(2)
+	const y = C.int(3)
+	for i := 0; i < b.N; i++ {
+		C.leafAdd(x, y)
+	}
+}
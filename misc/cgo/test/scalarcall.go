@@ -0,0 +1,117 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases and benchmarks for calls to C functions with
+// signatures of various shapes, which cgo may wrap differently.
+
+package cgotest
+
+/*
+#cgo leaf: scalarInt6Leaf scalarMixedLeaf
+#include <stddef.h>
+
+int scalarInt1(int a) { return a+1; }
+int scalarInt6(int a, int b, int c, int d, int e, int f) { return a+b+c+d+e+f; }
+int scalarInt6Leaf(int a, int b, int c, int d, int e, int f) { return a+b+c+d+e+f; }
+long long scalarInt8(int a, int b, int c, int d, int e, int f, int g, int h) { return a+b+c+d+e+f+g+h; }
+double scalarDouble2(double a, double b) { return a*b; }
+char *scalarPtr(char *p, size_t n) { return p+n; }
+
+double scalarMixed(char a, short b, int c, long long d, float e, double f) {
+	return (double)a+b+c+d+e+f;
+}
+double scalarMixedLeaf(char a, short b, int c, long long d, float e, double f) {
+	return (double)a+b+c+d+e+f;
+}
+
+struct scalarPair { int a; double b; };
+double scalarStruct(struct scalarPair p) { return p.a+p.b; }
+*/
+import "C"
+
+import (
+	"testing"
+	"unsafe"
+)
+
+func testScalarCall(t *testing.T) {
+	if got := C.scalarInt1(41); got != 42 {
+		t.Errorf("scalarInt1(41) = %d, want 42", got)
+	}
+	if got := C.scalarInt6(1, 2, 3, 4, 5, 6); got != 21 {
+		t.Errorf("scalarInt6 = %d, want 21", got)
+	}
+	if got := C.scalarInt6Leaf(1, 2, 3, 4, 5, 6); got != 21 {
+		t.Errorf("scalarInt6Leaf = %d, want 21", got)
+	}
+	if got := C.scalarInt8(1, 2, 3, 4, 5, 6, 7, 8); got != 36 {
+		t.Errorf("scalarInt8 = %d, want 36", got)
+	}
+	if got := C.scalarDouble2(1.5, 4); got != 6 {
+		t.Errorf("scalarDouble2(1.5, 4) = %v, want 6", got)
+	}
+	b := make([]byte, 8)
+	p := (*C.char)(unsafe.Pointer(&b[0]))
+	if got := C.scalarPtr(p, 5); got != (*C.char)(unsafe.Pointer(&b[5])) {
+		t.Errorf("scalarPtr(p, 5) = %p, want %p", got, &b[5])
+	}
+	if got := C.scalarMixed(1, 2, 3, 1<<40, 0.5, 0.25); got != 6+1<<40+0.75 {
+		t.Errorf("scalarMixed = %v, want %v", got, 6+1<<40+0.75)
+	}
+	if got := C.scalarMixedLeaf(-1, -2, -3, -1<<40, -0.5, -0.25); got != -6-1<<40-0.75 {
+		t.Errorf("scalarMixedLeaf = %v, want %v", got, -6-1<<40-0.75)
+	}
+	if got := C.scalarStruct(C.struct_scalarPair{a: 2, b: 0.5}); got != 2.5 {
+		t.Errorf("scalarStruct = %v, want 2.5", got)
+	}
+}
+
+func benchScalarInt1(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarInt1(1)
+	}
+}
+
+func benchScalarInt6(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarInt6(1, 2, 3, 4, 5, 6)
+	}
+}
+
+func benchScalarInt6Leaf(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarInt6Leaf(1, 2, 3, 4, 5, 6)
+	}
+}
+
+func benchScalarInt8(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarInt8(1, 2, 3, 4, 5, 6, 7, 8)
+	}
+}
+
+func benchScalarDouble2(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarDouble2(1.5, 2)
+	}
+}
+
+func benchScalarMixed(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarMixed(1, 2, 3, 4, 5, 6)
+	}
+}
+
+func benchScalarMixedLeaf(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		C.scalarMixedLeaf(1, 2, 3, 4, 5, 6)
+	}
+}
+
+func benchScalarStruct(b *testing.B) {
+	p := C.struct_scalarPair{a: 1, b: 2}
+	for i := 0; i < b.N; i++ {
+		C.scalarStruct(p)
+	}
+}
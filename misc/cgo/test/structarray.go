@@ -0,0 +1,200 @@
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Test cases for copying arrays of structs between Go and C
+// with C.CopyToC and C.CopyToGo.
+
+package cgotest
+
+/*
+#include <stdlib.h>
+
+struct sample { int id; double x; double y; };
+
+static struct sample *newSamples(int n) { return calloc(n, sizeof(struct sample)); }
+
+static void setSample(struct sample *s, int i, int id, double x, double y) {
+	s[i].id = id;
+	s[i].x = x;
+	s[i].y = y;
+}
+
+static double sumSamples(struct sample *s, int n) {
+	int i;
+	double sum;
+
+	sum = 0;
+	for(i = 0; i < n; i++)
+		sum += s[i].id + s[i].x*2 + s[i].y*3;
+	return sum;
+}
+*/
+import "C"
+
+import (
+	"testing"
+	"unsafe"
+)
+
+// A goSample has the layout of struct sample.
+type goSample struct {
+	ID   int32
+	X, Y float64
+}
+
+// A taggedSample has the fields of struct sample, and more,
+// in another order.
+type taggedSample struct {
+	X   float64
+	Tag string
+	Y   float64
+	ID  int32
+}
+
+// A badSample has a field of the wrong size.
+type badSample struct {
+	ID int64
+}
+
+// ptrSample and uptrSample have matching pointer fields.
+type ptrSample struct {
+	ID int32
+	P  *int32
+}
+
+type uptrSample struct {
+	ID int32
+	P  unsafe.Pointer
+}
+
+func samples(n int) []goSample {
+	s := make([]goSample, n)
+	for i := range s {
+		s[i] = goSample{int32(i), float64(i) / 2, float64(i) / 4}
+	}
+	return s
+}
+
+func taggedSamples(n int) []taggedSample {
+	s := make([]taggedSample, n)
+	for i := range s {
+		s[i] = taggedSample{X: float64(i) / 2, Tag: "t", Y: float64(i) / 4, ID: int32(i)}
+	}
+	return s
+}
+
+func sampleSum(n int) float64 {
+	sum := 0.0
+	for i := 0; i < n; i++ {
+		sum += float64(i) + float64(i)/2*2 + float64(i)/4*3
+	}
+	return sum
+}
+
+// cSamples returns s, which must hold n samples, as a Go slice.
+func cSamples(s *C.struct_sample, n int) []C.struct_sample {
+	return (*[1 << 24]C.struct_sample)(unsafe.Pointer(s))[:n:n]
+}
+
+func testCopyStructs(t *testing.T) {
+	const n = 1000
+	cs := C.newSamples(n)
+	defer C.free(unsafe.Pointer(cs))
+
+	if got := C.CopyToC(cs, samples(n)); got != n {
+		t.Errorf("CopyToC = %d, want %d", got, n)
+	}
+	if got, want := float64(C.sumSamples(cs, n)), sampleSum(n); got != want {
+		t.Errorf("after CopyToC of goSample, sum = %v, want %v", got, want)
+	}
+	back := make([]goSample, n)
+	if got := C.CopyToGo(back, cs); got != n {
+		t.Errorf("CopyToGo = %d, want %d", got, n)
+	}
+	for i, s := range samples(n) {
+		if back[i] != s {
+			t.Fatalf("after CopyToGo, goSample %d = %v, want %v", i, back[i], s)
+		}
+	}
+
+	// Between types of different layout.
+	C.CopyToC(cs, make([]goSample, n))
+	C.CopyToC(cs, taggedSamples(n))
+	if got, want := float64(C.sumSamples(cs, n)), sampleSum(n); got != want {
+		t.Errorf("after CopyToC of taggedSample, sum = %v, want %v", got, want)
+	}
+	tagged := make([]taggedSample, n)
+	for i := range tagged {
+		tagged[i].Tag = "kept"
+	}
+	C.CopyToGo(tagged, cs)
+	for i, s := range taggedSamples(n) {
+		s.Tag = "kept"
+		if tagged[i] != s {
+			t.Fatalf("after CopyToGo, taggedSample %d = %v, want %v", i, tagged[i], s)
+		}
+	}
+
+	// The C struct type itself.
+	csCopy := make([]C.struct_sample, n)
+	C.CopyToGo(csCopy, cs)
+	for i, s := range cSamples(cs, n) {
+		if csCopy[i] != s {
+			t.Fatalf("after CopyToGo, struct_sample %d = %v, want %v", i, csCopy[i], s)
+		}
+	}
+
+	mustPanic := func(what string, f func()) {
+		defer func() {
+			if recover() == nil {
+				t.Errorf("%s did not panic", what)
+			}
+		}()
+		f()
+	}
+	mustPanic("CopyToC of badSample", func() { C.CopyToC(cs, make([]badSample, 1)) })
+	mustPanic("CopyToGo of ptrSample", func() { C.CopyToGo(make([]ptrSample, 1), new(ptrSample)) })
+	mustPanic("CopyToGo of uptrSample", func() { C.CopyToGo(make([]ptrSample, 1), new(uptrSample)) })
+}
+
+const benchSamples = 1 << 20
+
+func benchSampleCopy(b *testing.B, f func(cs *C.struct_sample)) {
+	cs := C.newSamples(benchSamples)
+	defer C.free(unsafe.Pointer(cs))
+	b.SetBytes(benchSamples * C.sizeof_struct_sample)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		f(cs)
+	}
+}
+
+func benchStructArrayPerElem(b *testing.B) {
+	s := samples(benchSamples)
+	benchSampleCopy(b, func(cs *C.struct_sample) {
+		for i, e := range s {
+			C.setSample(cs, C.int(i), C.int(e.ID), C.double(e.X), C.double(e.Y))
+		}
+	})
+}
+
+func benchStructArrayCopyToC(b *testing.B) {
+	s := samples(benchSamples)
+	benchSampleCopy(b, func(cs *C.struct_sample) { C.CopyToC(cs, s) })
+}
+
+func benchStructArrayCopyToCGather(b *testing.B) {
+	s := taggedSamples(benchSamples)
+	benchSampleCopy(b, func(cs *C.struct_sample) { C.CopyToC(cs, s) })
+}
+
+func benchStructArrayCopyToGo(b *testing.B) {
+	s := make([]goSample, benchSamples)
+	benchSampleCopy(b, func(cs *C.struct_sample) { C.CopyToGo(s, cs) })
+}
+
+func benchStructArrayCopyToGoScatter(b *testing.B) {
+	s := make([]taggedSample, benchSamples)
+	benchSampleCopy(b, func(cs *C.struct_sample) { C.CopyToGo(s, cs) })
+}
@@ -0,0 +1,56 @@
+// Copyright 2015 The Go Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// Reports the cost of calling exported Go functions from C.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "p.h"
+#include "libgo.h"
+
+static int64_t
+nanotime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+	int i, n;
+	int64_t t0;
+	double sum;
+	GoString s = {"hello", 5};
+
+	n = 1000000;
+	if (argc > 1)
+		n = atoi(argv[1]);
+	if (getenv("GODEBUG") != NULL)
+		printf("GODEBUG=%s\n", getenv("GODEBUG"));
+
+	// The first call waits for the Go runtime to initialize.
+	FromPkg();
+
+	t0 = nanotime();
+	for (i = 0; i < n; i++)
+		FromPkg();
+	printf("FromPkg: %.1f ns/call\n", (double)(nanotime()-t0)/n);
+
+	sum = 0;
+	t0 = nanotime();
+	for (i = 0; i < n; i++)
+		sum += Sum3(1, i, 0.5);
+	printf("Sum3: %.1f ns/call\n", (double)(nanotime()-t0)/n);
+
+	t0 = nanotime();
+	for (i = 0; i < n; i++)
+		sum += Concat(s, s);
+	printf("Concat: %.1f ns/call\n", (double)(nanotime()-t0)/n);
+
+	return sum == 0;
+}
@@ -27,6 +27,11 @@ int main(void) {
 		return 2;
 	}
 
+	if (Sum3(-1, (int64_t)1<<40, 0.5) != (double)((int64_t)1<<40) - 0.5) {
+		fprintf(stderr, "ERROR: Sum3(-1, 1<<40, 0.5)=%g\n", Sum3(-1, (int64_t)1<<40, 0.5));
+		return 2;
+	}
+
 	CheckArgs();
 
 	fprintf(stderr, "PASS\n");
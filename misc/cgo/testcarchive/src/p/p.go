@@ -8,3 +8,9 @@ import "C"
 
 //export FromPkg
 func FromPkg() int32 { return 1024 }
+
+//export Sum3
+func Sum3(a int8, b int64, c float64) float64 { return float64(a) + float64(b) + c }
+
+//export Concat
+func Concat(a, b string) int { return len(a) + len(b) }
@@ -41,4 +41,17 @@ rm -f libgo.a libgo.h testp
 GOPATH=$(pwd) go build -buildmode=c-archive -o libgo.a libgo
 $(go env CC) $(go env GOGCCFLAGS) $ccargs -o testp main.c libgo.a
 $bin arg1 arg2
+
+# Report the cost of calls from C into Go, with the C thread
+# borrowing an M for each call and keeping one.  Unless GOCGOBENCH=1,
+# only make a few calls, to check that the benchmark still works.
+calls=1000
+out=/dev/null
+if [ "$GOCGOBENCH" == "1" ]; then
+	calls=${GOBENCHCALLS:-1000000}
+	out=/dev/stdout
+fi
+$(go env CC) $(go env GOGCCFLAGS) $ccargs -O2 -o testp bench.c libgo.a
+$bin $calls >$out
+GODEBUG=cgoworker=1 $bin $calls >$out
 rm -rf libgo.a libgo.h testp pkg
@@ -0,0 +1,70 @@
+// Copyright 2015 The Go Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "p.h"
+#include "libgo.h"
+
+// Many threads call into the library as soon as it is loaded,
+// while the Go runtime is still initializing, and then keep calling.
+// Reports the average time per call on standard error.
+
+enum {
+  nthreads = 8,
+  ncalls = 20000,
+};
+
+static int64_t now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void* caller(void* arg) {
+  int* bad = (int*)arg;
+  int i;
+
+  for (i = 0; i < ncalls; i++) {
+    if (FromPkg() != 1024) {
+      *bad = 1;
+    }
+  }
+  return NULL;
+}
+
+int main(void) {
+  pthread_t threads[nthreads];
+  int bad[nthreads] = {0};
+  int64_t start, first;
+  int i;
+
+  start = now();
+  for (i = 0; i < nthreads; i++) {
+    if (pthread_create(&threads[i], NULL, caller, &bad[i]) != 0) {
+      fprintf(stderr, "ERROR: pthread_create failed\n");
+      return 1;
+    }
+  }
+  // Once this returns the runtime is up; time the rest.
+  FromPkg();
+  first = now();
+  for (i = 0; i < nthreads; i++) {
+    pthread_join(threads[i], NULL);
+    if (bad[i]) {
+      fprintf(stderr, "ERROR: FromPkg returned unexpected results\n");
+      return 1;
+    }
+  }
+  fprintf(stderr, "test4: runtime ready after %lld us; %d threads x %d calls: %lld ns/call\n",
+          (long long)(first - start) / 1000, nthreads, ncalls,
+          (long long)(now() - first) / (nthreads * ncalls));
+  // test.bash looks for "PASS" to ensure this program has reached the end.
+  printf("PASS\n");
+  return 0;
+}
@@ -0,0 +1,50 @@
+// Copyright 2015 The Go Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <dlfcn.h>
+
+// Measures the time from dlopen of the shared library to the return
+// of the first call to an exported function, which waits for package
+// initialization. Reports it on standard error.
+
+static int64_t now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int main(int argc, char** argv) {
+  int64_t start, opened, called;
+  int32_t (*fn)();
+  void* handle;
+
+  start = now();
+  handle = dlopen(argv[1], RTLD_NOW | RTLD_GLOBAL);
+  if (!handle) {
+    fprintf(stderr, "ERROR: failed to open the shared library: %s\n",
+            dlerror());
+    return 1;
+  }
+  opened = now();
+  fn = (int32_t (*)())dlsym(handle, "FromPkg");
+  if (!fn) {
+    fprintf(stderr, "ERROR: missing FromPkg: %s\n", dlerror());
+    return 1;
+  }
+  if (fn() != 1024) {
+    fprintf(stderr, "ERROR: FromPkg returned unexpected results\n");
+    return 1;
+  }
+  called = now();
+  fprintf(stderr, "test5: dlopen %lld us, first call returned after %lld us\n",
+          (long long)(opened - start) / 1000,
+          (long long)(called - start) / 1000);
+  // test.bash looks for "PASS" to ensure this program has reached the end.
+  printf("PASS\n");
+  return 0;
+}
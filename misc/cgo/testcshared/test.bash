@@ -28,7 +28,7 @@ fi
 androidpath=/data/local/tmp/testcshared-$$
 
 function cleanup() {
-	rm -rf libgo.$libext libgo2.$libext libgo.h testp testp2 testp3 pkg
+	rm -rf libgo.$libext libgo2.$libext libgo.h testp testp2 testp3 testp4 testp5 pkg
 
 	rm -rf $(go env GOROOT)/${installdir}
 
@@ -116,6 +116,26 @@ if [ "$output" != "PASS" ]; then
 	exit 1
 fi
 
+# test4: many threads call exported functions right after the library loads.
+# Also reports the time per call on standard error.
+$(go env CC) $(go env GOGCCFLAGS) -I ${installdir} -o testp4 main4.c libgo.$libext -lpthread
+binpush testp4
+output=$(run LD_LIBRARY_PATH=. ./testp4)
+if [ "$output" != "PASS" ]; then
+	echo "FAIL test4 got ${output}"
+	exit 1
+fi
+
+# test5: time from dlopen to the return of the first exported call.
+# Reports the times on standard error.
+$(go env CC) $(go env GOGCCFLAGS) -o testp5 main5.c -ldl
+binpush testp5
+output=$(run ./testp5 ./libgo.$libext)
+if [ "$output" != "PASS" ]; then
+	echo "FAIL test5 got ${output}"
+	exit 1
+fi
+
 # test3: tests main.main is exported on android.
 if [ "$goos" == "android" ]; then
 	$(go env CC) $(go env GOGCCFLAGS) -o testp3 main3.c -ldl
@@ -5,7 +5,9 @@
 // This .cc file will be automatically compiled by the go tool and
 // included in the package.
 
+#include <string.h>
 #include <string>
+#include <vector>
 #include "callback.h"
 
 std::string Caller::call() {
@@ -13,3 +15,39 @@ std::string Caller::call() {
 		return callback_->run();
 	return "";
 }
+
+// callRef reports whether the callback's runRef returns want.
+bool Caller::callRef(StringRef want) {
+	StringRef s;
+
+	if (callback_ != 0)
+		s = callback_->runRef();
+	return s.n == want.n && (s.n == 0 || memcmp(s.p, want.p, s.n) == 0);
+}
+
+// drive runs the callback on 0, 1, ..., n-1 and returns the sum of
+// the results.  If batch is 0, it calls runInt once for each number;
+// otherwise it calls runBatch with batch numbers at a time.
+long long Caller::drive(long long n, int batch) {
+	long long sum = 0;
+
+	if (callback_ == 0)
+		return 0;
+	if (batch <= 0) {
+		for (long long i = 0; i < n; i++)
+			sum += callback_->runInt(i);
+		return sum;
+	}
+	std::vector<long long> in(batch), out(batch);
+	for (long long i = 0; i < n; i += batch) {
+		size_t m = batch;
+		if (n - i < batch)
+			m = n - i;
+		for (size_t j = 0; j < m; j++)
+			in[j] = i + j;
+		callback_->runBatch(Int64Array(&in[0], m), Int64Array(&out[0], m));
+		for (size_t j = 0; j < m; j++)
+			sum += out[j];
+	}
+	return sum;
+}
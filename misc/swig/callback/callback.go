@@ -9,3 +9,17 @@ type GoCallback struct{}
 func (p *GoCallback) Run() string {
 	return "GoCallback.Run"
 }
+
+func (p *GoCallback) RunRef() string {
+	return "GoCallback.RunRef"
+}
+
+func (p *GoCallback) RunInt(x int64) int64 {
+	return x + 1
+}
+
+func (p *GoCallback) RunBatch(in, out []int64) {
+	for i, x := range in {
+		out[i] = x + 1
+	}
+}
@@ -2,10 +2,41 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
+#include <stddef.h>
+
+// A StringRef is a string that its receiver does not own:
+// a pointer and a length, valid only for the duration of the call
+// that passed or returned it.  In Go it is a string, passed
+// without copying (see callback.swigcxx).
+struct StringRef {
+	const char *p;
+	size_t n;
+	StringRef(): p(0), n(0) { }
+	StringRef(const char *p, size_t n): p(p), n(n) { }
+};
+
+// An Int64Array is an array of n integers that its receiver does not
+// own, valid for the duration of the call.  In Go it is an []int64
+// sharing the C++ memory.
+struct Int64Array {
+	long long *p;
+	size_t n;
+	Int64Array(): p(0), n(0) { }
+	Int64Array(long long *p, size_t n): p(p), n(n) { }
+};
+
 class Callback {
 public:
 	virtual ~Callback() { }
 	virtual std::string run() { return "Callback::run"; }
+	virtual StringRef runRef() { return StringRef("Callback::runRef", 16); }
+	virtual long long runInt(long long x) { return x + 1; }
+	// runBatch sets out.p[i] to runInt(in.p[i]) for each i,
+	// so that a director makes one call for the whole array.
+	virtual void runBatch(Int64Array in, Int64Array out) {
+		for (size_t i = 0; i < in.n && i < out.n; i++)
+			out.p[i] = runInt(in.p[i]);
+	}
 };
 
 class Caller {
@@ -17,4 +48,6 @@ public:
 	void delCallback() { delete callback_; callback_ = 0; }
 	void setCallback(Callback *cb) { delCallback(); callback_ = cb; }
 	std::string call();
+	bool callRef(StringRef want);
+	long long drive(long long n, int batch);
 };
@@ -31,3 +31,82 @@ func TestCallback(t *testing.T) {
 	c.DelCallback()
 	DeleteDirectorCallback(cb)
 }
+
+func TestCallbackRef(t *testing.T) {
+	c := NewCaller()
+	cb := NewDirectorCallback(&GoCallback{})
+	c.SetCallback(cb)
+	if !c.CallRef("GoCallback.RunRef") {
+		t.Error("CallRef with callback did not see GoCallback.RunRef")
+	}
+	if c.CallRef("GoCallback.Run") {
+		t.Error("CallRef with callback matched the wrong string")
+	}
+	c.DelCallback()
+	DeleteDirectorCallback(cb)
+}
+
+func BenchmarkCallback(b *testing.B) {
+	c := NewCaller()
+	cb := NewDirectorCallback(&GoCallback{})
+	c.SetCallback(cb)
+	for i := 0; i < b.N; i++ {
+		if c.Call() != "GoCallback.Run" {
+			b.Fatal("unexpected string from Call with callback")
+		}
+	}
+	c.DelCallback()
+	DeleteDirectorCallback(cb)
+}
+
+func BenchmarkCallbackRef(b *testing.B) {
+	c := NewCaller()
+	cb := NewDirectorCallback(&GoCallback{})
+	c.SetCallback(cb)
+	for i := 0; i < b.N; i++ {
+		if !c.CallRef("GoCallback.RunRef") {
+			b.Fatal("unexpected string from CallRef with callback")
+		}
+	}
+	c.DelCallback()
+	DeleteDirectorCallback(cb)
+}
+
+func TestCallbackBatch(t *testing.T) {
+	const n = 1000
+	const want = n * (n + 1) / 2
+	c := NewCaller()
+	c.SetCallback(NewCallback())
+	if got := c.Drive(n, 64); got != want {
+		t.Errorf("Drive(%d, 64) = %d, want %d", n, got, want)
+	}
+	cb := NewDirectorCallback(&GoCallback{})
+	c.SetCallback(cb)
+	for _, batch := range []int{0, 1, 64, 999, 1024} {
+		if got := c.Drive(n, batch); got != want {
+			t.Errorf("Drive(%d, %d) with callback = %d, want %d", n, batch, got, want)
+		}
+	}
+	c.DelCallback()
+	DeleteDirectorCallback(cb)
+}
+
+// benchDrive has C++ make 10 million calls to a Go director,
+// batch at a time, for each iteration.
+func benchDrive(b *testing.B, batch int) {
+	const n = 10000000
+	c := NewCaller()
+	cb := NewDirectorCallback(&GoCallback{})
+	c.SetCallback(cb)
+	for i := 0; i < b.N; i++ {
+		if c.Drive(n, batch) != n*(n+1)/2 {
+			b.Fatal("unexpected sum from Drive with callback")
+		}
+	}
+	c.DelCallback()
+	DeleteDirectorCallback(cb)
+}
+
+func BenchmarkDriveSingle(b *testing.B)    { benchDrive(b, 0) }
+func BenchmarkDriveBatch64(b *testing.B)   { benchDrive(b, 64) }
+func BenchmarkDriveBatch1024(b *testing.B) { benchDrive(b, 1024) }
@@ -4,7 +4,13 @@
 
 package file
 
-import "testing"
+import (
+	"bytes"
+	"flag"
+	"io/ioutil"
+	"os"
+	"testing"
+)
 
 // Open this file itself and verify that the first few characters are
 // as expected.
@@ -20,3 +26,106 @@ func TestRead(t *testing.T) {
 		t.Error("fclose failed")
 	}
 }
+
+func TestReadWriteBytes(t *testing.T) {
+	want, err := ioutil.ReadFile("file_test.go")
+	if err != nil {
+		t.Fatal(err)
+	}
+	f := Fopen("file_test.go", "r")
+	if f.Swigcptr() == 0 {
+		t.Fatal("fopen failed")
+	}
+	buf := make([]byte, len(want)+1)
+	if n := int(Fread(f, buf)); n != len(want) || !bytes.Equal(buf[:n], want) {
+		t.Errorf("fread read %d bytes, want %d", n, len(want))
+	}
+	Fclose(f)
+
+	f = Fopen("file_test.go", "r")
+	var lines []byte
+	for {
+		n := Fgets(f, buf[:16])
+		if n < 0 {
+			break
+		}
+		lines = append(lines, buf[:n]...)
+	}
+	Fclose(f)
+	if !bytes.Equal(lines, want) {
+		t.Errorf("fgets read %d bytes, want %d", len(lines), len(want))
+	}
+
+	tmp, err := ioutil.TempFile("", "stdio")
+	if err != nil {
+		t.Fatal(err)
+	}
+	tmp.Close()
+	defer os.Remove(tmp.Name())
+	f = Fopen(tmp.Name(), "w")
+	if n := int(Fwrite(f, want)); n != len(want) {
+		t.Errorf("fwrite wrote %d bytes, want %d", n, len(want))
+	}
+	Fclose(f)
+	if got, err := ioutil.ReadFile(tmp.Name()); err != nil || !bytes.Equal(got, want) {
+		t.Errorf("after fwrite, file holds %d bytes, want %d (%v)", len(got), len(want), err)
+	}
+}
+
+var fileSize = flag.Int64("filesize", 1<<30, "size of the file the benchmarks read")
+
+// benchRead reads a file of -filesize bytes of lines with read
+// for each iteration.
+func benchRead(b *testing.B, read func(f SWIGTYPE_p_FILE)) {
+	tmp, err := ioutil.TempFile("", "stdio")
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer os.Remove(tmp.Name())
+	line := []byte("The quick brown fox jumps over the lazy dog, again and again.\n")
+	chunk := bytes.Repeat(line, 1<<16/len(line))
+	for n := int64(0); n < *fileSize; n += int64(len(chunk)) {
+		c := chunk
+		if *fileSize-n < int64(len(c)) {
+			c = c[:*fileSize-n]
+		}
+		if _, err := tmp.Write(c); err != nil {
+			b.Fatal(err)
+		}
+	}
+	tmp.Close()
+
+	b.SetBytes(*fileSize)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		f := Fopen(tmp.Name(), "r")
+		if f.Swigcptr() == 0 {
+			b.Fatal("fopen failed")
+		}
+		read(f)
+		Fclose(f)
+	}
+}
+
+func BenchmarkFgetc(b *testing.B) {
+	benchRead(b, func(f SWIGTYPE_p_FILE) {
+		for Fgetc(f) >= 0 {
+		}
+	})
+}
+
+func BenchmarkFgets(b *testing.B) {
+	buf := make([]byte, 1024)
+	benchRead(b, func(f SWIGTYPE_p_FILE) {
+		for Fgets(f, buf) >= 0 {
+		}
+	})
+}
+
+func BenchmarkFread(b *testing.B) {
+	buf := make([]byte, 1<<16)
+	benchRead(b, func(f SWIGTYPE_p_FILE) {
+		for Fread(f, buf) > 0 {
+		}
+	})
+}
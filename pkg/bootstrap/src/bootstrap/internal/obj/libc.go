@@ -0,0 +1,15 @@
+// Do not edit. Bootstrap copy of /root/repo/src/cmd/internal/obj/libc.go
+
+//line /root/repo/src/cmd/internal/obj/libc.go:1
+// Copyright 2015 The Go Authors.  All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+package obj
+
+const (
+	AEXIST = 0
+	BOM    = 0xFEFF
+)
+
+var GOEXPERIMENT string
@@ -0,0 +1,18 @@
+// Do not edit. Bootstrap copy of /root/repo/src/cmd/internal/obj/zbootstrap.go
+
+//line /root/repo/src/cmd/internal/obj/zbootstrap.go:1
+// auto generated by go tool dist
+
+package obj
+
+import "runtime"
+
+const defaultGOROOT = `/root/repo`
+const defaultGO386 = `sse2`
+const defaultGOARM = `5`
+const defaultGOOS = runtime.GOOS
+const defaultGOARCH = runtime.GOARCH
+const defaultGO_EXTLINK_ENABLED = ``
+const version = `go1.5`
+const stackGuardMultiplier = 1
+const goexperiment = ``
@@ -0,0 +1,4 @@
+// Do not edit. Bootstrap copy of /root/repo/src/cmd/link/internal/amd64/z.go
+
+//line /root/repo/src/cmd/link/internal/amd64/z.go:1
+package amd64